@@ -0,0 +1,115 @@
+﻿using System;
+
+// Measures how long the game has been in the background or shut down.
+// Two anchors are persisted: UTC ticks, which are independent of locale, time zone and DST, and the boot clock
+// (see BootClock), which the user can't set. While the device hasn't rebooted the boot clock decides, so moving
+// the wall clock either way gains nothing.
+//
+// Limits: after a reboot only the wall clock is left. Setting it back is detected with a high-water mark, setting
+// it forward is not. A reboot is only noticed when the boot clock reads less than the anchor, so a device that
+// rebooted and has since been up longer than it had been at the anchor is rewarded for the uptime difference only.
+public class BackgroundClock
+{
+    public const long UnknownBootTicks = -1;
+
+    // Persisted with the save record, 0 when the game is in the foreground
+    public long backgroundSinceUtcTicks;
+
+    // Persisted with the save record, BootClock reading taken with backgroundSinceUtcTicks
+    public long backgroundSinceBootTicks = UnknownBootTicks;
+
+    // Persisted with the save record, the latest wall clock time the game has seen
+    public long latestUtcTicks;
+
+    private readonly Func<long> _utcNow;
+    private readonly Func<long> _bootNow;
+
+    public BackgroundClock() : this(() => DateTime.UtcNow.Ticks, BootClock.Now)
+    {
+    }
+
+    public BackgroundClock(Func<long> utcNow, Func<long> bootNow)
+    {
+        _utcNow = utcNow;
+        _bootNow = bootNow;
+    }
+
+    public void EnterBackground()
+    {
+        var now = Now();
+
+        // Pausing before a quit must not move the anchor forward
+        if (backgroundSinceUtcTicks == 0)
+        {
+            backgroundSinceUtcTicks = now;
+            backgroundSinceBootTicks = _bootNow();
+        }
+    }
+
+    // Legacy saves stored pause and shutdown times as DateTime.Now.ToString(), anchors to the later one.
+    // They carry no boot clock reading, so only the wall clock is used for them.
+    public void MigrateLegacyTimestamps(params string[] localTimes)
+    {
+        var backgroundSince = DateTime.MinValue;
+        foreach (var localTime in localTimes)
+        {
+            DateTime time;
+            if (DateTime.TryParse(localTime, out time) &&
+                time > backgroundSince)
+            {
+                backgroundSince = time;
+            }
+        }
+
+        if (backgroundSince != DateTime.MinValue)
+        {
+            backgroundSinceUtcTicks = backgroundSince.ToUniversalTime().Ticks;
+            backgroundSinceBootTicks = UnknownBootTicks;
+        }
+    }
+
+    // Returns the seconds spent in the background since EnterBackground and clears the anchor
+    public int ConsumeBackgroundSeconds()
+    {
+        if (backgroundSinceUtcTicks == 0)
+        {
+            return 0;
+        }
+
+        var nowTicks = _utcNow();
+        var nowBootTicks = _bootNow();
+        var clockSetBack = nowTicks < latestUtcTicks;
+        long elapsedTicks = 0;
+
+        if (backgroundSinceBootTicks != UnknownBootTicks && nowBootTicks >= backgroundSinceBootTicks)
+        {
+            elapsedTicks = nowBootTicks - backgroundSinceBootTicks;
+        }
+        else if (!clockSetBack)
+        {
+            elapsedTicks = nowTicks - backgroundSinceUtcTicks;
+        }
+
+        // Without a boot clock reading an interval across a set-back can't be trusted and is worth nothing.
+        // Restart the high-water mark from the current clock, otherwise a mark left in the future would
+        // distrust every later interval until real time catches up with it.
+        if (clockSetBack)
+        {
+            latestUtcTicks = nowTicks;
+        }
+
+        backgroundSinceUtcTicks = 0;
+        backgroundSinceBootTicks = UnknownBootTicks;
+        Now();
+
+        return (int) Math.Min(Math.Max(elapsedTicks / TimeSpan.TicksPerSecond, 0), int.MaxValue);
+    }
+
+    // Reads the wall clock and advances the high-water mark used to detect the clock being set back
+    public long Now()
+    {
+        var nowTicks = _utcNow();
+        latestUtcTicks = Math.Max(latestUtcTicks, nowTicks);
+        return nowTicks;
+    }
+}
@@ -0,0 +1,39 @@
+﻿using System;
+using System.Diagnostics;
+#if UNITY_IOS && !UNITY_EDITOR
+using System.Runtime.InteropServices;
+#endif
+using UnityEngine;
+
+// Time since the device booted, in ticks. Unlike the wall clock it can't be set by the user, and it keeps
+// counting while the device sleeps, but it restarts from zero on every boot.
+public static class BootClock
+{
+#if UNITY_ANDROID && !UNITY_EDITOR
+    private static AndroidJavaClass _systemClock;
+
+    public static long Now()
+    {
+        if (_systemClock == null)
+            _systemClock = new AndroidJavaClass("android.os.SystemClock");
+
+        return _systemClock.CallStatic<long>("elapsedRealtime") * TimeSpan.TicksPerMillisecond;
+    }
+#elif UNITY_IOS && !UNITY_EDITOR
+    [DllImport("__Internal")]
+    private static extern long _GetBootTimeNanoseconds();
+
+    public static long Now()
+    {
+        return _GetBootTimeNanoseconds() / 100;
+    }
+#else
+    // Stopwatch reads the system monotonic clock, close enough to a boot clock in the editor
+    public static long Now()
+    {
+        var timestamp = Stopwatch.GetTimestamp();
+        return timestamp / Stopwatch.Frequency * TimeSpan.TicksPerSecond +
+               timestamp % Stopwatch.Frequency * TimeSpan.TicksPerSecond / Stopwatch.Frequency;
+    }
+#endif
+}
@@ -11,11 +11,11 @@ using Debug = UnityEngine.Debug;
 public class GameState : MonoBehaviour
 {
     public long credits;
-    public int income = 1;
+    public long income = 1;
     public int level = 1;
     private int nrOfUpgrades = 0;
-    public int upgradeCost = 10;
-    public int nextUpgradeSize = 1;
+    public long upgradeCost = 10;
+    public long nextUpgradeSize = 1;
     public AudioSource sfx;
     public AudioClip upgradeSound;
     public ParticleSystem upgradeEffect;
@@ -36,30 +36,25 @@ public class GameState : MonoBehaviour
 
     public static int upgradesToReachLevel = 5;
 
+    // Income is counted up in the credits display over at most this many frames
+    public const int IncomeDisplayFrames = 20;
 
-    IEnumerator IncrementTo(long incrementTo, int incomeSize)
+    private readonly BackgroundClock _backgroundClock = new BackgroundClock();
+    private readonly PendingIncome _pendingIncome = new PendingIncome(IncomeDisplayFrames);
+
+    public void GainIncome(long incomeSize, int times = 1)
     {
-        int numberOfLoops = 0;
-        while (credits < incrementTo)
-        {
-            if (credits + incomeSize > incrementTo || numberOfLoops > 20)
-            {
-                credits = incrementTo;
-            }
-            else
-            {
-                credits += incomeSize;
-                numberOfLoops++;
-                yield return new WaitForSeconds(0.00001F);
-            }
-        }
+        _pendingIncome.Add(incomeSize, times);
     }
 
-    public void GainIncome(int incomeSize, int times = 1)
+    private void Update()
     {
-        var newCredits = incomeSize * times;
-        var incrementTo = newCredits + credits;
-        StartCoroutine(IncrementTo(incrementTo, incomeSize));
+        credits = _pendingIncome.Step(credits);
+    }
+
+    private void AddPendingIncome()
+    {
+        credits = _pendingIncome.Flush(credits);
     }
 
     public string GetCreditsForDisplay()
@@ -76,10 +71,10 @@ public class GameState : MonoBehaviour
     {
         if (credits >= upgradeCost)
         {
-            income += nextUpgradeSize;
-            nextUpgradeSize *= 2;
+            income = GameStateUtil.SaturatingAdd(income, nextUpgradeSize);
+            nextUpgradeSize = GameStateUtil.SaturatingMultiply(nextUpgradeSize, 2);
             credits -= upgradeCost;
-            upgradeCost *= 3;
+            upgradeCost = GameStateUtil.SaturatingMultiply(upgradeCost, 3);
             nrOfUpgrades += 1;
 
             if (GetNrToNextUpgrade() == upgradesToReachLevel)
@@ -145,6 +140,7 @@ public class GameState : MonoBehaviour
     private void Awake()
     {
         LoadState();
+        AwardBackgroundIncome();
         ChangesForLevel();
     }
 
@@ -160,15 +156,17 @@ public class GameState : MonoBehaviour
 
     private void OnApplicationQuit()
     {
-        SaveState();
-        PersistShutdownTime();
+        // The process is about to exit, don't leave the write to a background thread
+        _backgroundClock.EnterBackground();
+        AddPendingIncome();
+        SaveGameStore.Save(CreateSaveRecord());
     }
 
     private void OnApplicationFocus(bool hasFocus)
     {
         if (hasFocus)
         {
-            LoadState();
+            AwardBackgroundIncome();
         }
         else
         {
@@ -176,35 +174,37 @@ public class GameState : MonoBehaviour
         }
     }
 
-    private static int CalculateBackgroundIncomeTicks(string dateTimeLastRegistration)
-    {
-        return (int) (DateTime.Now - DateTime.Parse(dateTimeLastRegistration)).TotalSeconds;
-    }
-
     private void OnDisable()
     {
         SaveState();
     }
 
+    // Written behind on a background thread, focus changes don't wait for the disk
     private void SaveState()
     {
-        PlayerPrefs.SetString("credits", credits.ToString());
-        PlayerPrefs.SetInt("income", income);
-        PlayerPrefs.SetInt("upgradeCost", upgradeCost);
-        PlayerPrefs.SetInt("nextUpgradeSize", nextUpgradeSize);
-        PlayerPrefs.SetInt("level", level);
-        PlayerPrefs.SetInt("nrOfUpgrades", nrOfUpgrades);
-        PlayerPrefs.Save();
+        AddPendingIncome();
+        SaveGameStore.SaveAsync(CreateSaveRecord());
     }
 
-    private void PersistShutdownTime()
+    private SaveRecord CreateSaveRecord()
     {
-        PlayerPrefs.SetString("lastShutdown", DateTime.Now.ToString());
+        return new SaveRecord
+        {
+            credits = credits,
+            income = income,
+            upgradeCost = upgradeCost,
+            nextUpgradeSize = nextUpgradeSize,
+            level = level,
+            nrOfUpgrades = nrOfUpgrades,
+            backgroundSinceUtcTicks = _backgroundClock.backgroundSinceUtcTicks,
+            backgroundSinceBootTicks = _backgroundClock.backgroundSinceBootTicks,
+            latestUtcTicks = _backgroundClock.Now()
+        };
     }
 
     private void SaveOnPause()
     {
-        PlayerPrefs.SetString("lastPause", DateTime.Now.ToString());
+        _backgroundClock.EnterBackground();
         SaveState();
     }
 
@@ -212,49 +212,69 @@ public class GameState : MonoBehaviour
     public void ClearPlayerPrefs()
     {
         PlayerPrefs.DeleteAll();
+        SaveGameStore.Delete();
     }
 
+    // The in-memory state is authoritative while running, this is only read once on startup
     private void LoadState()
+    {
+        SaveRecord record;
+        if (!SaveGameStore.TryLoad(out record))
+        {
+            LoadLegacyState();
+            return;
+        }
+
+        credits = record.credits;
+        income = record.income;
+        upgradeCost = record.upgradeCost;
+        nextUpgradeSize = record.nextUpgradeSize;
+        level = record.level;
+        nrOfUpgrades = record.nrOfUpgrades;
+        _backgroundClock.backgroundSinceUtcTicks = record.backgroundSinceUtcTicks;
+        _backgroundClock.backgroundSinceBootTicks = record.backgroundSinceBootTicks;
+        _backgroundClock.latestUtcTicks = record.latestUtcTicks;
+    }
+
+    // Games saved before the binary save record kept their state in PlayerPrefs
+    private static readonly string[] LegacyKeys =
+        {"credits", "income", "upgradeCost", "nextUpgradeSize", "level", "nrOfUpgrades", "lastPause", "lastShutdown"};
+
+    private void LoadLegacyState()
     {
         credits = Convert.ToInt64(PlayerPrefs.GetString("credits", credits.ToString()));
-        upgradeCost = PlayerPrefs.GetInt("upgradeCost", upgradeCost);
-        income = PlayerPrefs.GetInt("income", income);
-        nextUpgradeSize = PlayerPrefs.GetInt("nextUpgradeSize", nextUpgradeSize);
+        upgradeCost = PlayerPrefs.GetInt("upgradeCost", (int) upgradeCost);
+        income = PlayerPrefs.GetInt("income", (int) income);
+        nextUpgradeSize = PlayerPrefs.GetInt("nextUpgradeSize", (int) nextUpgradeSize);
         nrOfUpgrades = PlayerPrefs.GetInt("nrOfUpgrades", nrOfUpgrades);
         level = PlayerPrefs.GetInt("level", level);
 
-        int rewardedBackgroundIncome = locationIncome.CalculateBackgroundIncome(GetBackgroundSeconds(), income);
-        GainIncome(income, rewardedBackgroundIncome);
+        _backgroundClock.MigrateLegacyTimestamps(PlayerPrefs.GetString("lastPause", null),
+            PlayerPrefs.GetString("lastShutdown", null));
+
+        MigrateLegacyState();
     }
 
-    private int GetBackgroundSeconds()
+    // Only drop the legacy keys once the binary save holds the same state, so a failed write loses nothing
+    private void MigrateLegacyState()
     {
-        int incomeFromShutDown = 0;
-        if (PlayerPrefs.HasKey("lastShutdown"))
+        if (!Array.Exists(LegacyKeys, PlayerPrefs.HasKey) || !SaveGameStore.Save(CreateSaveRecord()))
         {
-            incomeFromShutDown = CalculateBackgroundIncomeTicks(PlayerPrefs.GetString("lastShutdown"));
-            PlayerPrefs.DeleteKey("lastShutdown");
+            return;
         }
 
-        int incomeFromPause = 0;
-        if (PlayerPrefs.HasKey("lastPause"))
+        foreach (var key in LegacyKeys)
         {
-            incomeFromPause = CalculateBackgroundIncomeTicks(PlayerPrefs.GetString("lastPause"));
-            PlayerPrefs.DeleteKey("lastPause");
+            PlayerPrefs.DeleteKey(key);
         }
 
-        if (incomeFromPause > 0 || incomeFromShutDown > 0)
-        {
-            if (incomeFromPause > incomeFromShutDown)
-            {
-                return incomeFromPause;
-            }
-            else
-            {
-                return incomeFromShutDown;
-            }
-        }
+        PlayerPrefs.Save();
+    }
 
-        return 0;
+    private void AwardBackgroundIncome()
+    {
+        var backgroundSeconds = _backgroundClock.ConsumeBackgroundSeconds();
+        int rewardedBackgroundIncome = locationIncome.CalculateBackgroundIncome(backgroundSeconds, income);
+        GainIncome(income, rewardedBackgroundIncome);
     }
 }
\ No newline at end of file
@@ -5,6 +5,16 @@ public class GameStateUtil
 
     public static string FormatNumber(long number)
     {
+        if (number > 999999999999999 || number < -999999999999999)
+        {
+            return number.ToString("0,,,,,.###Q", CultureInfo.InvariantCulture);
+        }
+        else
+        if (number > 999999999999 || number < -999999999999)
+        {
+            return number.ToString("0,,,,.###T", CultureInfo.InvariantCulture);
+        }
+        else
         if (number > 999999999 || number < -999999999 )
         {
             return number.ToString("0,,,.###B", CultureInfo.InvariantCulture);
@@ -24,4 +34,21 @@ public class GameStateUtil
             return number.ToString(CultureInfo.InvariantCulture);
         }
     }
+
+    // Costs and income grow geometrically, clamp at long.MaxValue instead of wrapping around to negative values.
+    // Both operands are expected to be non-negative.
+    public static long SaturatingMultiply(long a, long b)
+    {
+        if (a == 0 || b == 0)
+        {
+            return 0;
+        }
+
+        return a > long.MaxValue / b ? long.MaxValue : a * b;
+    }
+
+    public static long SaturatingAdd(long a, long b)
+    {
+        return a > long.MaxValue - b ? long.MaxValue : a + b;
+    }
 }
\ No newline at end of file
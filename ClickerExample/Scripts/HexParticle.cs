@@ -1,13 +1,20 @@
 ﻿using System;
+using System.Collections.Generic;
 using UnityEngine;
 
 public class HexParticle : MonoBehaviour
 {
     public GameObject swapsTo;
     public GameState gameState;
-    private int income;
+    private long income;
     private int level;
     public bool isColoredByValue;
+    private Rigidbody _rigidBody;
+
+    private void Awake()
+    {
+        _rigidBody = GetComponent<Rigidbody>();
+    }
 
     public void Start()
     {
@@ -20,17 +27,26 @@ public class HexParticle : MonoBehaviour
         }
     }
 
+    // One material per source material and level, shared by every particle instead of cloned per particle
+    private static readonly Dictionary<(Material, int), Material> materialsByLevel =
+        new Dictionary<(Material, int), Material>();
+
     private void colorByValue()
     {
         var mesh = gameObject.GetComponentInChildren<MeshRenderer>();
+        var sourceMaterial = mesh.sharedMaterial;
 
-        var newMaterial = Instantiate(mesh.material);
-        var newMaterialColor = Color.HSVToRGB((level * 100 % 255) / 255f, 1f, 0.78f, true);
+        if (!materialsByLevel.TryGetValue((sourceMaterial, level), out var levelMaterial) || levelMaterial == null)
+        {
+            levelMaterial = Instantiate(sourceMaterial);
+            var newMaterialColor = Color.HSVToRGB((level * 100 % 255) / 255f, 1f, 0.78f, true);
 
-        newMaterial.color = newMaterialColor;
-        newMaterial.SetColor("_EmissionColor", newMaterialColor);
+            levelMaterial.color = newMaterialColor;
+            levelMaterial.SetColor("_EmissionColor", newMaterialColor);
+            materialsByLevel[(sourceMaterial, level)] = levelMaterial;
+        }
 
-        mesh.material = newMaterial;
+        mesh.sharedMaterial = levelMaterial;
     }
 
 
@@ -40,9 +56,8 @@ public class HexParticle : MonoBehaviour
         var originalTransform = original.transform;
         var newObject = Instantiate(swapsTo, originalTransform.position, originalTransform.rotation);
         var rigidBody = newObject.GetComponent<Rigidbody>();
-        var originalRigidBody = original.GetComponent<Rigidbody>();
-        rigidBody.velocity = originalRigidBody.velocity;
-        rigidBody.angularVelocity = originalRigidBody.angularVelocity;
+        rigidBody.velocity = _rigidBody.velocity;
+        rigidBody.angularVelocity = _rigidBody.angularVelocity;
 
         Destroy(original);
 
@@ -20,13 +20,13 @@ public class LocationIncome : MonoBehaviour
     }
 
     //Checks to see if game has been closed while tracking was enabled and awards the corresponding income.
-    public int CalculateBackgroundIncome(int seconds, int gameIncome)
+    public int CalculateBackgroundIncome(int seconds, long gameIncome)
     {
         var rewardedSeconds = CalculateRewardedSeconds(seconds);
 
         if (tracking.IsTracking() && rewardedSeconds > 0)
         {
-            backgroundRewardDialog.Show(GameStateUtil.FormatNumber(rewardedSeconds * gameIncome));
+            backgroundRewardDialog.Show(GameStateUtil.FormatNumber(GameStateUtil.SaturatingMultiply(rewardedSeconds, gameIncome)));
             return rewardedSeconds;
         }
 
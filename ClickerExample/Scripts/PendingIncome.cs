@@ -0,0 +1,53 @@
+﻿using System;
+
+// Income gained but not yet added to credits. It is counted up over a few frames so the credits display
+// animates instead of jumping.
+public class PendingIncome
+{
+    private readonly int _frames;
+    private long _amount;
+    private long _step;
+
+    public PendingIncome(int frames)
+    {
+        _frames = frames;
+    }
+
+    public long Amount => _amount;
+
+    public void Add(long incomeSize, int times = 1)
+    {
+        var newCredits = GameStateUtil.SaturatingMultiply(incomeSize, times);
+        if (newCredits <= 0)
+        {
+            return;
+        }
+
+        _amount = GameStateUtil.SaturatingAdd(_amount, newCredits);
+
+        // Rounded up, so all of it is added within the frame count
+        var step = _amount / _frames + (_amount % _frames == 0 ? 0 : 1);
+        _step = Math.Max(incomeSize, step);
+    }
+
+    // Returns credits with this frame's share of the pending income added
+    public long Step(long credits)
+    {
+        if (_amount <= 0)
+        {
+            return credits;
+        }
+
+        var step = Math.Min(_step, _amount);
+        _amount -= step;
+        return GameStateUtil.SaturatingAdd(credits, step);
+    }
+
+    // Returns credits with all of the pending income added
+    public long Flush(long credits)
+    {
+        var amount = _amount;
+        _amount = 0;
+        return GameStateUtil.SaturatingAdd(credits, amount);
+    }
+}
@@ -0,0 +1,277 @@
+﻿using System;
+using System.IO;
+using System.Threading;
+using UnityEngine;
+
+public struct SaveRecord
+{
+    public long credits;
+    public long income;
+    public long upgradeCost;
+    public long nextUpgradeSize;
+    public int level;
+    public int nrOfUpgrades;
+
+    // See BackgroundClock
+    public long backgroundSinceUtcTicks;
+    public long backgroundSinceBootTicks;
+    public long latestUtcTicks;
+}
+
+// Stores the game state as one small versioned binary file.
+// Saves are written behind on a thread pool thread and replace the previous file atomically,
+// so a crash mid-write leaves the last complete save in place.
+public static class SaveGameStore
+{
+    private const int Magic = 0x50434C4B; // "PCLK"
+    private const int Version = 1;
+    private const string FileName = "savegame.bin";
+
+    // QueueLock only guards the queued record so the game thread never waits for disk I/O, WriteLock serializes the writes
+    private static readonly object QueueLock = new object();
+    private static readonly object WriteLock = new object();
+    private static SaveRecord _queuedRecord;
+    private static int _queuedSequence;
+    private static int _writtenSequence;
+    private static bool _isWriting;
+    private static bool _savingBlocked;
+
+    private static string SavePath
+    {
+        get { return Path.Combine(Application.persistentDataPath, FileName); }
+    }
+
+    // Returns false if there is no save, or if it could not be read. An unreadable save is moved aside
+    // (or, if that fails, saving is disabled) so the fallback state never overwrites it.
+    public static bool TryLoad(out SaveRecord record)
+    {
+        record = new SaveRecord();
+        var path = SavePath;
+        if (!File.Exists(path))
+        {
+            return false;
+        }
+
+        string error;
+        try
+        {
+            using (var reader = new BinaryReader(File.OpenRead(path)))
+            {
+                error = ReadRecord(reader, ref record);
+            }
+        }
+        catch (Exception e)
+        {
+            error = e.Message;
+        }
+
+        if (error == null)
+        {
+            return true;
+        }
+
+        record = new SaveRecord();
+        SetAside(path, error);
+        return false;
+    }
+
+    // Returns null on success, otherwise why the record could not be read
+    private static string ReadRecord(BinaryReader reader, ref SaveRecord record)
+    {
+        if (reader.ReadInt32() != Magic)
+        {
+            return "unknown format";
+        }
+
+        var version = reader.ReadInt32();
+        if (version != Version)
+        {
+            return "unsupported version " + version;
+        }
+
+        record.credits = reader.ReadInt64();
+        record.income = reader.ReadInt64();
+        record.upgradeCost = reader.ReadInt64();
+        record.nextUpgradeSize = reader.ReadInt64();
+        record.level = reader.ReadInt32();
+        record.nrOfUpgrades = reader.ReadInt32();
+        record.backgroundSinceUtcTicks = reader.ReadInt64();
+        record.backgroundSinceBootTicks = reader.ReadInt64();
+        record.latestUtcTicks = reader.ReadInt64();
+
+        return null;
+    }
+
+    private static void SetAside(string path, string error)
+    {
+        var unreadablePath = path + ".unreadable";
+        try
+        {
+            File.Delete(unreadablePath);
+            File.Move(path, unreadablePath);
+            Debug.LogWarning("Could not read save game (" + error + "), moved it to " + unreadablePath);
+        }
+        catch (Exception e)
+        {
+            lock (QueueLock)
+            {
+                _savingBlocked = true;
+            }
+
+            Debug.LogError("Could not read save game (" + error + ") or move it aside (" + e.Message + "). " +
+                           "Saving is disabled until the next launch so it isn't overwritten: " + path);
+        }
+    }
+
+    // Queues the record to be written on a background thread. Only the latest queued record is written.
+    public static void SaveAsync(SaveRecord record)
+    {
+        var path = SavePath;
+        lock (QueueLock)
+        {
+            if (_savingBlocked)
+            {
+                return;
+            }
+
+            _queuedRecord = record;
+            _queuedSequence++;
+            if (_isWriting)
+            {
+                return;
+            }
+
+            _isWriting = true;
+        }
+
+        ThreadPool.QueueUserWorkItem(_ => WriteQueued(path));
+    }
+
+    // Writes on the calling thread, for when the process may not live long enough for the background write.
+    // Returns true once the record (or a newer one) is on disk.
+    public static bool Save(SaveRecord record)
+    {
+        int sequence;
+        lock (QueueLock)
+        {
+            if (_savingBlocked)
+            {
+                return false;
+            }
+
+            _queuedRecord = record;
+            sequence = ++_queuedSequence;
+        }
+
+        try
+        {
+            WriteIfNewer(SavePath, record, sequence);
+            return true;
+        }
+        catch (Exception e)
+        {
+            Debug.LogWarning("Could not write save game: " + e.Message);
+            return false;
+        }
+    }
+
+    public static void Delete()
+    {
+        lock (WriteLock)
+        {
+            lock (QueueLock)
+            {
+                _writtenSequence = ++_queuedSequence;
+            }
+
+            File.Delete(SavePath);
+            lock (QueueLock)
+            {
+                _savingBlocked = false;
+            }
+        }
+    }
+
+    private static void WriteQueued(string path)
+    {
+        while (true)
+        {
+            SaveRecord record;
+            int sequence;
+            lock (QueueLock)
+            {
+                if (_queuedSequence == _writtenSequence)
+                {
+                    _isWriting = false;
+                    return;
+                }
+
+                record = _queuedRecord;
+                sequence = _queuedSequence;
+            }
+
+            try
+            {
+                WriteIfNewer(path, record, sequence);
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarning("Could not write save game: " + e.Message);
+                lock (QueueLock)
+                {
+                    _isWriting = false;
+                }
+                return;
+            }
+        }
+    }
+
+    // A synchronous Save may overtake a background write, never let an older record replace a newer one
+    private static void WriteIfNewer(string path, SaveRecord record, int sequence)
+    {
+        lock (WriteLock)
+        {
+            if (sequence <= _writtenSequence)
+            {
+                return;
+            }
+
+            Write(path, record);
+            lock (QueueLock)
+            {
+                _writtenSequence = sequence;
+            }
+        }
+    }
+
+    private static void Write(string path, SaveRecord record)
+    {
+        var tempPath = path + ".tmp";
+        using (var stream = new FileStream(tempPath, FileMode.Create, FileAccess.Write))
+        using (var writer = new BinaryWriter(stream))
+        {
+            writer.Write(Magic);
+            writer.Write(Version);
+            writer.Write(record.credits);
+            writer.Write(record.income);
+            writer.Write(record.upgradeCost);
+            writer.Write(record.nextUpgradeSize);
+            writer.Write(record.level);
+            writer.Write(record.nrOfUpgrades);
+            writer.Write(record.backgroundSinceUtcTicks);
+            writer.Write(record.backgroundSinceBootTicks);
+            writer.Write(record.latestUtcTicks);
+            writer.Flush();
+            stream.Flush(true);
+        }
+
+        if (File.Exists(path))
+        {
+            File.Replace(tempPath, path, null);
+        }
+        else
+        {
+            File.Move(tempPath, path);
+        }
+    }
+}
@@ -5,6 +5,7 @@ public class CreditsText : MonoBehaviour
 {
     public GameState gameState;
     private Text _text;
+    private long _displayedValue = long.MinValue;
 
     // Start is called before the first frame update
     void Start()
@@ -15,6 +16,13 @@ public class CreditsText : MonoBehaviour
     // Update is called once per frame
     void Update()
     {
+        // Only format (and allocate) when the value changes
+        if (gameState.credits == _displayedValue)
+        {
+            return;
+        }
+
+        _displayedValue = gameState.credits;
         _text.text = gameState.GetCreditsForDisplay();
     }
 }
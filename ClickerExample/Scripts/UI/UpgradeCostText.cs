@@ -5,6 +5,7 @@ public class UpgradeCostText : MonoBehaviour
 {
     public GameState state;
     private Text _text;
+    private long _displayedValue = long.MinValue;
 
     // Start is called before the first frame update
     void Start()
@@ -15,6 +16,13 @@ public class UpgradeCostText : MonoBehaviour
     // Update is called once per frame
     void Update()
     {
+        // Only format (and allocate) when the value changes
+        if (state.upgradeCost == _displayedValue)
+        {
+            return;
+        }
+
+        _displayedValue = state.upgradeCost;
         _text.text = GameStateUtil.FormatNumber(state.upgradeCost);
     }
 }
@@ -7,6 +7,7 @@ public class UpgradeSizeText : MonoBehaviour
 {
     public GameState state;
     private Text _text;
+    private long _displayedValue = long.MinValue;
 
     // Start is called before the first frame update
     void Start()
@@ -17,6 +18,13 @@ public class UpgradeSizeText : MonoBehaviour
     // Update is called once per frame
     void Update()
     {
+        // Only format (and allocate) when the value changes
+        if (state.nextUpgradeSize == _displayedValue)
+        {
+            return;
+        }
+
+        _displayedValue = state.nextUpgradeSize;
         _text.text = "+" + GameStateUtil.FormatNumber(state.nextUpgradeSize);
     }
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+﻿using System;
+using NUnit.Framework;
+
+public class BackgroundClockTests
+{
+    private static readonly long Start = new DateTime(2019, 10, 17, 12, 0, 0, DateTimeKind.Utc).Ticks;
+
+    private long _utcTicks;
+    private long _bootTicks;
+    private BackgroundClock _clock;
+
+    [SetUp]
+    public void SetUp()
+    {
+        _utcTicks = Start;
+        _bootTicks = TimeSpan.FromHours(1).Ticks;
+        _clock = new BackgroundClock(() => _utcTicks, () => _bootTicks);
+    }
+
+    private void Elapse(TimeSpan wall, TimeSpan boot)
+    {
+        _utcTicks += wall.Ticks;
+        _bootTicks += boot.Ticks;
+    }
+
+    // Simulates a quit and relaunch, only the persisted fields survive
+    private void Restart(bool reboot)
+    {
+        var saved = _clock;
+        _clock = new BackgroundClock(() => _utcTicks, () => _bootTicks)
+        {
+            backgroundSinceUtcTicks = saved.backgroundSinceUtcTicks,
+            backgroundSinceBootTicks = saved.backgroundSinceBootTicks,
+            latestUtcTicks = saved.latestUtcTicks
+        };
+
+        if (reboot)
+        {
+            _bootTicks = 0;
+        }
+    }
+
+    [Test]
+    public void NothingInForeground()
+    {
+        Elapse(TimeSpan.FromHours(1), TimeSpan.FromHours(1));
+
+        Assert.AreEqual(0, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void PauseIsMeasured()
+    {
+        _clock.EnterBackground();
+        Elapse(TimeSpan.FromMinutes(5), TimeSpan.FromMinutes(5));
+
+        Assert.AreEqual(300, _clock.ConsumeBackgroundSeconds());
+        Assert.AreEqual(0, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void PauseThenQuitKeepsTheFirstAnchor()
+    {
+        _clock.EnterBackground();
+        Elapse(TimeSpan.FromMinutes(2), TimeSpan.FromMinutes(2));
+        _clock.EnterBackground();
+        Restart(false);
+        Elapse(TimeSpan.FromMinutes(3), TimeSpan.FromMinutes(3));
+
+        Assert.AreEqual(300, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void ClockSetForwardWithinBootGainsNothing()
+    {
+        _clock.EnterBackground();
+        Restart(false);
+        Elapse(TimeSpan.FromDays(2), TimeSpan.FromMinutes(1));
+
+        Assert.AreEqual(60, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void ClockSetBackWithinBootLosesNothing()
+    {
+        _clock.EnterBackground();
+        Elapse(-TimeSpan.FromDays(1), TimeSpan.FromMinutes(10));
+
+        Assert.AreEqual(600, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void RebootUsesTheWallClock()
+    {
+        _clock.EnterBackground();
+        Restart(true);
+        Elapse(TimeSpan.FromHours(2), TimeSpan.Zero);
+
+        Assert.AreEqual(7200, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void ClockSetBackAcrossRebootIsWorthNothing()
+    {
+        _clock.EnterBackground();
+        Restart(true);
+        Elapse(-TimeSpan.FromHours(1), TimeSpan.Zero);
+
+        Assert.AreEqual(0, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void HighWaterMarkResetsAfterSetBack()
+    {
+        // Played with the clock a day ahead, then set it right and rebooted
+        Elapse(TimeSpan.FromDays(1), TimeSpan.Zero);
+        _clock.Now();
+        Elapse(-TimeSpan.FromDays(1), TimeSpan.Zero);
+        _clock.EnterBackground();
+        Restart(true);
+        Elapse(TimeSpan.FromMinutes(1), TimeSpan.FromMinutes(1));
+        Assert.AreEqual(0, _clock.ConsumeBackgroundSeconds());
+
+        // The next interval is trusted again instead of waiting a day for real time to catch up
+        _clock.EnterBackground();
+        Restart(true);
+        Elapse(TimeSpan.FromMinutes(5), TimeSpan.Zero);
+        Assert.AreEqual(300, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void LegacyTimestampsUseTheLaterOne()
+    {
+        var now = new DateTime(_utcTicks, DateTimeKind.Utc).ToLocalTime();
+        _clock.MigrateLegacyTimestamps(now.AddMinutes(-30).ToString(), now.AddMinutes(-10).ToString(), null);
+
+        Assert.AreEqual(BackgroundClock.UnknownBootTicks, _clock.backgroundSinceBootTicks);
+        Assert.AreEqual(600, _clock.ConsumeBackgroundSeconds());
+    }
+
+    [Test]
+    public void UnparsableLegacyTimestampsAreIgnored()
+    {
+        _clock.MigrateLegacyTimestamps("not a date", null);
+
+        Assert.AreEqual(0, _clock.backgroundSinceUtcTicks);
+        Assert.AreEqual(0, _clock.ConsumeBackgroundSeconds());
+    }
+}
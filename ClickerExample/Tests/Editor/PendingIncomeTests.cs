@@ -0,0 +1,59 @@
+﻿using NUnit.Framework;
+
+public class PendingIncomeTests
+{
+    private const int Frames = GameState.IncomeDisplayFrames;
+
+    [Test]
+    public void FinishesWithinDisplayFrames()
+    {
+        foreach (var amount in new long[] {1, 19, 39, 1000, 123456789, long.MaxValue})
+        {
+            var pending = new PendingIncome(Frames);
+            pending.Add(amount);
+
+            long credits = 0;
+            for (var frame = 0; frame < Frames; frame++)
+            {
+                credits = pending.Step(credits);
+            }
+
+            Assert.AreEqual(0, pending.Amount, "amount " + amount);
+            Assert.AreEqual(amount, credits, "amount " + amount);
+        }
+    }
+
+    [Test]
+    public void ConcurrentGainAndUpgradeLoseNoCredits()
+    {
+        var pending = new PendingIncome(Frames);
+        long credits = 1000;
+
+        pending.Add(10, 50);
+        credits = pending.Step(credits);
+        credits = pending.Step(credits);
+
+        // A click lands while the first gain is still counting up, then an upgrade is bought
+        pending.Add(10);
+        credits -= 600;
+
+        for (var frame = 0; frame < Frames; frame++)
+        {
+            credits = pending.Step(credits);
+        }
+
+        Assert.AreEqual(0, pending.Amount);
+        Assert.AreEqual(1000 + 500 + 10 - 600, credits);
+    }
+
+    [Test]
+    public void FlushAddsEverythingPending()
+    {
+        var pending = new PendingIncome(Frames);
+        pending.Add(7, 3);
+        var credits = pending.Step(5);
+
+        Assert.AreEqual(5 + 21, pending.Flush(credits));
+        Assert.AreEqual(0, pending.Amount);
+    }
+}
@@ -18,41 +18,55 @@ public class IOSPostProcessor : IPostprocessBuildWithReport
         if (report.summary.platform == BuildTarget.iOS)
         {
 #if UNITY_IOS
-            AddPlistEntries(report);
-            AddShellScriptBuildPhase(report);
+            // Settings and paths are resolved once and shared by both steps
+            var settings = PureSDKSettingsEditor.GetOrCreateSettings();
+            var pathToBuiltProject = report.summary.outputPath;
+            AddPlistEntries(pathToBuiltProject, settings);
+            AddShellScriptBuildPhase(pathToBuiltProject);
 #endif
         }
     }
 #if UNITY_IOS
-    private void AddShellScriptBuildPhase(BuildReport report)
+    private const string StripFrameworksScript =
+        "bash \"${BUILT_PRODUCTS_DIR}/${FRAMEWORKS_FOLDER_PATH}/PureSDK.framework/strip-frameworks.sh\"";
+
+    private void AddShellScriptBuildPhase(string pathToBuiltProject)
     {
-        var pathToBuiltProject = report.summary.outputPath;
-        string projPath = PBXProject.GetPBXProjectPath(report.summary.outputPath);
+        string projPath = PBXProject.GetPBXProjectPath(pathToBuiltProject);
+        var projContents = File.ReadAllText(projPath);
+
+        // "Append" builds reuse the existing Xcode project, the build phase is already there
+        if (projContents.Contains("PureSDK.framework/strip-frameworks.sh"))
+        {
+            return;
+        }
 
         PBXProject proj = new PBXProject();
-        proj.ReadFromString(File.ReadAllText(projPath));
+        proj.ReadFromString(projContents);
 
         proj.InsertShellScriptBuildPhase(100, proj.TargetGuidByName("Unity-iPhone"),
             "Strip Invalid Archs",
             "/bin/sh",
-            "bash \"${BUILT_PRODUCTS_DIR}/${FRAMEWORKS_FOLDER_PATH}/PureSDK.framework/strip-frameworks.sh\"");
+            StripFrameworksScript);
         proj.WriteToFile(projPath);
     }
 
-    private void AddPlistEntries(BuildReport report)
+    private void AddPlistEntries(string pathToBuiltProject, PureSDKSettings settings)
     {
-        var plistPath = GetPlistPath(report);
+        var plistPath = pathToBuiltProject + "/Info.plist";
+        var plistContents = File.ReadAllText(plistPath);
         var plist = new PlistDocument();
-        plist.ReadFromFile(plistPath);
+        plist.ReadFromString(plistContents);
         var rootDict = plist.root;
 
-        SetPlistKey(rootDict, "PURPublisherId", PureSDKSettingsEditor.GetOrCreateSettings().publisherID);
+        SetPlistKey(rootDict, "PURPublisherId", settings.publisherID);
 
-        if (!PureSDKSettingsEditor.GetOrCreateSettings().generateLocationPlistEntries)
+        if (!settings.generateLocationPlistEntries)
         {
             WarnIfMissing(rootDict, "NSLocationWhenInUseUsageDescription");
             WarnIfMissing(rootDict, "NSLocationAlwaysUsageDescription");
-            WarnIfMissing(rootDict, "NSLocationWhenInUseUsageDescription");
+            WarnIfMissing(rootDict, "NSLocationAlwaysAndWhenInUseUsageDescription");
+            WriteIfChanged(plistPath, plistContents, plist.WriteToString());
             return;
         }
 
@@ -68,18 +82,25 @@ public class IOSPostProcessor : IPostprocessBuildWithReport
         SetPlistKey(rootDict, "NSLocationAlwaysUsageDescription", locationUsageDescription);
 
         //Second permission pop-up
-        if (PureSDKSettingsEditor.GetOrCreateSettings().askForAlwaysText == null ||
-            PureSDKSettingsEditor.GetOrCreateSettings().askForAlwaysText.Trim() == "")
+        if (settings.askForAlwaysText == null || settings.askForAlwaysText.Trim() == "")
         {
             SetPlistKey(rootDict, "NSLocationAlwaysAndWhenInUseUsageDescription", locationUsageDescription);
         }
         else
         {
-            SetPlistKey(rootDict, "NSLocationAlwaysAndWhenInUseUsageDescription", PureSDKSettingsEditor.GetOrCreateSettings().askForAlwaysText);
+            SetPlistKey(rootDict, "NSLocationAlwaysAndWhenInUseUsageDescription", settings.askForAlwaysText);
         }
 
-        // Write to file
-        File.WriteAllText(plistPath, plist.WriteToString());
+        WriteIfChanged(plistPath, plistContents, plist.WriteToString());
+    }
+
+    // Leaves the file (and its timestamp) untouched when a rebuild produces identical contents
+    private static void WriteIfChanged(string path, string original, string updated)
+    {
+        if (updated != original)
+        {
+            File.WriteAllText(path, updated);
+        }
     }
 
     private static void WarnIfMissing(PlistElementDict rootDict, string key)
@@ -92,18 +113,6 @@ public class IOSPostProcessor : IPostprocessBuildWithReport
         }
     }
 
-    private static string GetPlistPath(BuildReport report)
-    {
-        var pathToBuiltProject = report.summary.outputPath;
-        string projPath = PBXProject.GetPBXProjectPath(report.summary.outputPath);
-
-        PBXProject proj = new PBXProject();
-        proj.ReadFromString(File.ReadAllText(projPath));
-
-        var plistPath = pathToBuiltProject + "/Info.plist";
-        return plistPath;
-    }
-
     private static void SetPlistKey(PlistElementDict rootDict, string key, string value)
     {
         if (rootDict[key] != null && rootDict[key].AsString() != value)
@@ -50,6 +50,9 @@ class PureSDKSettingsMenu : SettingsProvider
                 break;
         }
 
+        GUILayout.Space(20);
+        EditorMenu();
+
 //        AssetDatabase.SaveAssets();
     }
     
@@ -82,7 +85,28 @@ class PureSDKSettingsMenu : SettingsProvider
             EditorGUILayout.HelpBox(
                 "If you already define all or some of these PList entries elsewhere, you should handle this by editing your .plist files directly.",
                 MessageType.Warning);
-        }   
+        }
+
+        GUILayout.Space(20);
+        GUILayout.Label("Analytics", EditorStyles.boldLabel);
+        EditorGUILayout.HelpBox(
+            "Lightweight analytics lets the SDK include session lengths in the payloads it already sends when tracking is started or stopped.",
+            MessageType.Info);
+        settings.lightweightAnalyticsEnabled =
+            EditorGUILayout.ToggleLeft("Enable lightweight analytics", settings.lightweightAnalyticsEnabled);
+    }
+
+    private void EditorMenu()
+    {
+        GUILayout.Label("Editor simulation", EditorStyles.boldLabel);
+        EditorGUILayout.HelpBox(
+            "In the editor and on unsupported platforms the SDK is mocked. " +
+            "These options let you test how your game handles a slow or denied location permission prompt.",
+            MessageType.Info);
+        settings.fakePermissionDelaySeconds = Mathf.Max(0,
+            EditorGUILayout.FloatField("Permission prompt delay (seconds)", settings.fakePermissionDelaySeconds));
+        settings.fakePermissionDenied =
+            EditorGUILayout.ToggleLeft("Deny location permission", settings.fakePermissionDenied);
     }
 
     private void AndroidMenu()
@@ -137,7 +161,8 @@ class PureSDKSettingsMenu : SettingsProvider
             keywords = new HashSet<string>(new[]
             {
                 "SDK", "Pure", "PublisherID", "mainTemplate", "gradle", "NSLocationWhenInUseUsageDescription",
-                "NSLocationAlwaysUsageDescription", "NSLocationAlwaysAndWhenInUseUsageDescription"
+                "NSLocationAlwaysUsageDescription", "NSLocationAlwaysAndWhenInUseUsageDescription",
+                "Lightweight analytics", "Editor simulation", "Permission prompt delay", "Deny location permission"
             })
         };
 
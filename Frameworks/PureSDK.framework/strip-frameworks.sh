@@ -45,14 +45,16 @@ for file in $(find . -type f -perm +111); do
   # Get architectures for current file
   archs="$(lipo -info "${file}" | rev | cut -d ':' -f1 | rev)"
   stripped=""
+  remove_args=()
   for arch in $archs; do
     if ! [[ "${VALID_ARCHS}" == *"$arch"* ]]; then
-      # Strip non-valid architectures in-place
-      lipo -remove "$arch" -output "$file" "$file" || exit 1
+      remove_args+=(-remove "$arch")
       stripped="$stripped $arch"
     fi
   done
   if [[ "$stripped" != "" ]]; then
+    # Strip all non-valid architectures in-place with a single rewrite of the binary
+    lipo "${remove_args[@]}" -output "$file" "$file" || exit 1
     echo "Stripped $file of architectures:$stripped"
     if [ "${CODE_SIGNING_REQUIRED}" == "YES" ]; then
       code_sign "${file}"
@@ -6,22 +6,29 @@ namespace Unaty.PureSDK
 {
     internal class AndroidBridge : IPureSdk
     {
+        // Cached copy of the SDK's persisted state, only ever read back from the SDK
         private bool isTracking;
         private bool _waitingForUserToAcceptLocation;
+        private string _publisherId;
 
 #if UNITY_ANDROID
+        private const string BackgroundLocationPermission = "android.permission.ACCESS_BACKGROUND_LOCATION";
+
+        private readonly AndroidJavaObject _activity;
         private readonly AndroidJavaObject _applicationContext;
+        private readonly int _sdkInt;
 #endif
         public AndroidBridge()
         {
 #if UNITY_ANDROID
             var unityPlayer = new AndroidJavaClass("com.unity3d.player.UnityPlayer");
-            var activity = unityPlayer.GetStatic<AndroidJavaObject>("currentActivity");
-            _applicationContext = activity.Call<AndroidJavaObject>("getApplicationContext");
+            _activity = unityPlayer.GetStatic<AndroidJavaObject>("currentActivity");
+            _applicationContext = _activity.Call<AndroidJavaObject>("getApplicationContext");
+            _sdkInt = new AndroidJavaClass("android.os.Build$VERSION").GetStatic<int>("SDK_INT");
 
             var sdk = GetSDK();
-            var publisherId = PureSDKSettings.ReadOnlyCopy().publisherID;
-            sdk.Call("init", publisherId, null);
+            _publisherId = PureSDKSettings.ReadOnlyCopy().publisherID;
+            sdk.Call("init", _publisherId, null);
             isTracking = sdk.Call<bool>("isTracking");
 #endif
         }
@@ -43,17 +50,19 @@ namespace Unaty.PureSDK
                 _waitingForUserToAcceptLocation = true;
             }
 
-            GetSDK().Call("startTracking");
-            isTracking = true;
+            var sdk = GetSDK();
+            sdk.Call("startTracking");
+            isTracking = sdk.Call<bool>("isTracking");
 #endif
         }
 
         public void StopTracking()
         {
 #if UNITY_ANDROID
-            GetSDK().Call("stopTracking");
+            var sdk = GetSDK();
+            sdk.Call("stopTracking");
+            isTracking = sdk.Call<bool>("isTracking");
 #endif
-            isTracking = false;
         }
 
         public bool IsTracking()
@@ -65,5 +74,61 @@ namespace Unaty.PureSDK
 
             return isTracking && !_waitingForUserToAcceptLocation;
         }
+
+        // The Android SDK only takes the publisher id through init
+        public void SetPublisherId(string publisherId)
+        {
+            if (publisherId == _publisherId)
+            {
+                return;
+            }
+
+            _publisherId = publisherId;
+#if UNITY_ANDROID
+            GetSDK().Call("init", _publisherId, null);
+#endif
+        }
+
+        // Not cached, every call queries the permission state through JNI.
+        // isUserMonitized is not reported by the Android SDK and is always false.
+        public PureTrackingInfo GetTrackingInfo()
+        {
+            var info = new PureTrackingInfo {isTrackingEnabled = IsTracking()};
+#if UNITY_ANDROID
+            info.locationServicesEnabled = Input.location.isEnabledByUser;
+            info.locationAuthorization = GetLocationAuthorization();
+#endif
+            return info;
+        }
+
+#if UNITY_ANDROID
+        private LocationAuthorization GetLocationAuthorization()
+        {
+            if (Permission.HasUserAuthorizedPermission(Permission.FineLocation))
+            {
+                // From Android 10 fine location only covers foreground use, background needs its own grant
+                return _sdkInt < 29 || Permission.HasUserAuthorizedPermission(BackgroundLocationPermission)
+                    ? LocationAuthorization.AuthorizedAlways
+                    : LocationAuthorization.AuthorizedWhenInUse;
+            }
+
+            // Android only tells us about earlier refusals through the rationale flag. A refusal with
+            // "Don't ask again" can't be told apart from a permission that was never requested.
+            return _activity.Call<bool>("shouldShowRequestPermissionRationale", Permission.FineLocation)
+                ? LocationAuthorization.Denied
+                : LocationAuthorization.NotDetermined;
+        }
+#endif
+
+        // Not exposed by the Android SDK
+        public string GetPureIdentifier()
+        {
+            return null;
+        }
+
+        public string GetVersion()
+        {
+            return null;
+        }
     }
 }
\ No newline at end of file
@@ -5,20 +5,97 @@ namespace Unaty.PureSDK
 {
     internal class FakeBridge : IPureSdk
     {
+        private const string MockedIsTrackingKey = "mockedIsTracking";
+
+        // Read once, PlayerPrefs is only written when the state actually changes
+        private bool _isTracking = PlayerPrefs.GetInt(MockedIsTrackingKey) == 1;
+
+        // Simulates the system permission dialog, see AndroidBridge for the real equivalent
+        private readonly float _permissionDelaySeconds;
+        private readonly bool _permissionDenied;
+        private float _permissionGrantedAt;
+
+        public FakeBridge(float permissionDelaySeconds = 0, bool permissionDenied = false)
+        {
+            _permissionDelaySeconds = permissionDelaySeconds;
+            _permissionDenied = permissionDenied;
+        }
 
         public void StartTracking()
         {
-            PlayerPrefs.SetInt("mockedIsTracking", 1);
+            // A denied prompt leaves tracking off, like on a device
+            if (_permissionDenied)
+            {
+                return;
+            }
+
+            if (!_isTracking)
+            {
+                _permissionGrantedAt = Time.realtimeSinceStartup + _permissionDelaySeconds;
+            }
+
+            SetTracking(true);
         }
 
         public void StopTracking()
         {
-            PlayerPrefs.SetInt("mockedIsTracking", 0);
+            SetTracking(false);
         }
 
         public bool IsTracking()
         {
-            return PlayerPrefs.GetInt("mockedIsTracking") == 1;
+            return _isTracking && HasPermission();
+        }
+
+        private bool HasPermission()
+        {
+            return !_permissionDenied && Time.realtimeSinceStartup >= _permissionGrantedAt;
+        }
+
+        private void SetTracking(bool isTracking)
+        {
+            if (_isTracking == isTracking)
+            {
+                return;
+            }
+
+            _isTracking = isTracking;
+            PlayerPrefs.SetInt(MockedIsTrackingKey, isTracking ? 1 : 0);
+        }
+
+        public void SetPublisherId(string publisherId)
+        {
+        }
+
+        public PureTrackingInfo GetTrackingInfo()
+        {
+            var authorization = LocationAuthorization.NotDetermined;
+            if (_permissionDenied)
+            {
+                authorization = LocationAuthorization.Denied;
+            }
+            else if (_isTracking && HasPermission())
+            {
+                authorization = LocationAuthorization.AuthorizedAlways;
+            }
+
+            return new PureTrackingInfo
+            {
+                isTrackingEnabled = IsTracking(),
+                locationServicesEnabled = true,
+                locationAuthorization = authorization,
+                isUserMonitized = IsTracking()
+            };
+        }
+
+        public string GetPureIdentifier()
+        {
+            return "mocked-pure-identifier";
+        }
+
+        public string GetVersion()
+        {
+            return "mocked";
         }
     }
 }
\ No newline at end of file
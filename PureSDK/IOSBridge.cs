@@ -1,4 +1,5 @@
 ﻿using System.Runtime.InteropServices;
+using System.Text;
 using PureSDK;
 using UnityEngine;
 
@@ -17,15 +18,44 @@ internal class IosBridge : IPureSdk
     [DllImport("__Internal")]
     private static extern void _SetPublisherID(string publisherId);
 
+    [DllImport("__Internal")]
+    private static extern void _SetLightweightAnalyticsEnabled(bool enabled);
+
+    [DllImport("__Internal")]
+    private static extern int _GetInfoGeneration();
+
+    [DllImport("__Internal")]
+    private static extern bool _IsLocationServicesEnabled();
+
+    [DllImport("__Internal")]
+    private static extern int _GetLocationAuthorization();
+
+    [DllImport("__Internal")]
+    private static extern bool _IsUserMonitized();
+
+    [DllImport("__Internal")]
+    private static extern int _CopyPureIdentifier(byte[] buffer, int length);
+
+    [DllImport("__Internal")]
+    private static extern int _CopyVersion(byte[] buffer, int length);
+
     #endif
     
-    private bool _isTracking;
+    #if UNITY_IOS
+    // The SDK persists tracking state itself, so there is no local copy of it here.
+    // Values cached natively are only marshalled again when the native generation counter changes
+    private readonly byte[] _utf8Buffer = new byte[128];
+    private int _infoGeneration = -1;
+    private PureTrackingInfo _trackingInfo;
+    private string _pureIdentifier;
+    private string _version;
+    #endif
     
     public IosBridge()
     {
         #if UNITY_IOS
-        _isTracking = _IsTracking();
-        Debug.Log("Checking the SDK if we are tracking. SDK reports isTracking = " + _isTracking);
+        _SetLightweightAnalyticsEnabled(PureSDKSettings.ReadOnlyCopy().lightweightAnalyticsEnabled);
+        Debug.Log("Checking the SDK if we are tracking. SDK reports isTracking = " + IsTracking());
         #endif
     }
 
@@ -34,8 +64,7 @@ internal class IosBridge : IPureSdk
         Debug.Log("Start tracking");
         #if UNITY_IOS
         _StartTracking();
-        _isTracking = true;
-        Debug.Log("Start tracking setting tracking = " + _isTracking);
+        Debug.Log("Start tracking setting tracking = " + IsTracking());
         #endif
     }
     
@@ -43,19 +72,80 @@ internal class IosBridge : IPureSdk
     {
         #if UNITY_IOS
         _StopTracking();
-        _isTracking = false;
-        Debug.Log("Stop tracking setting tracking = " + _isTracking);
+        Debug.Log("Stop tracking setting tracking = " + IsTracking());
         #endif
     }
 
     public bool IsTracking()
     {
         #if UNITY_IOS
-        return _isTracking;
+        RefreshInfo();
+        return _trackingInfo.isTrackingEnabled;
         #endif
         #if !UNITY_IOS
         return false;
         #endif
 
     }
+
+    public void SetPublisherId(string publisherId)
+    {
+        #if UNITY_IOS
+        _SetPublisherID(publisherId);
+        #endif
+    }
+
+    public PureTrackingInfo GetTrackingInfo()
+    {
+        #if UNITY_IOS
+        RefreshInfo();
+        return _trackingInfo;
+        #else
+        return new PureTrackingInfo();
+        #endif
+    }
+
+    public string GetPureIdentifier()
+    {
+        #if UNITY_IOS
+        RefreshInfo();
+        return _pureIdentifier;
+        #else
+        return null;
+        #endif
+    }
+
+    public string GetVersion()
+    {
+        #if UNITY_IOS
+        RefreshInfo();
+        return _version;
+        #else
+        return null;
+        #endif
+    }
+
+    #if UNITY_IOS
+    private void RefreshInfo()
+    {
+        var generation = _GetInfoGeneration();
+        if (generation == _infoGeneration)
+        {
+            return;
+        }
+
+        _infoGeneration = generation;
+        _trackingInfo.isTrackingEnabled = _IsTracking();
+        _trackingInfo.locationServicesEnabled = _IsLocationServicesEnabled();
+        _trackingInfo.locationAuthorization = (LocationAuthorization) _GetLocationAuthorization();
+        _trackingInfo.isUserMonitized = _IsUserMonitized();
+        _pureIdentifier = ReadString(_CopyPureIdentifier(_utf8Buffer, _utf8Buffer.Length));
+        _version = ReadString(_CopyVersion(_utf8Buffer, _utf8Buffer.Length));
+    }
+
+    private string ReadString(int length)
+    {
+        return length > 0 ? Encoding.UTF8.GetString(_utf8Buffer, 0, length) : null;
+    }
+    #endif
 }
\ No newline at end of file
@@ -7,5 +7,13 @@ namespace PureSDK
         void StopTracking();
 
         bool IsTracking();
+
+        void SetPublisherId(string publisherId);
+
+        PureTrackingInfo GetTrackingInfo();
+
+        string GetPureIdentifier();
+
+        string GetVersion();
     }
 }
\ No newline at end of file
@@ -1,32 +1,46 @@
 using PureSDK;
+using Unity.Profiling;
 using UnityEngine;
 
 namespace Unaty.PureSDK
 {
     public class PureSDK : IPureSdk
     {
-        
+        // Shows bridge cost, including the native call, under its own name in the Unity Profiler
+        private static readonly ProfilerMarker InitMarker = new ProfilerMarker("PureSDK.Init");
+        private static readonly ProfilerMarker StartTrackingMarker = new ProfilerMarker("PureSDK.StartTracking");
+        private static readonly ProfilerMarker StopTrackingMarker = new ProfilerMarker("PureSDK.StopTracking");
+        private static readonly ProfilerMarker IsTrackingMarker = new ProfilerMarker("PureSDK.IsTracking");
+        private static readonly ProfilerMarker SetPublisherIdMarker = new ProfilerMarker("PureSDK.SetPublisherId");
+        private static readonly ProfilerMarker GetTrackingInfoMarker = new ProfilerMarker("PureSDK.GetTrackingInfo");
+        private static readonly ProfilerMarker GetPureIdentifierMarker = new ProfilerMarker("PureSDK.GetPureIdentifier");
+        private static readonly ProfilerMarker GetVersionMarker = new ProfilerMarker("PureSDK.GetVersion");
+
         private readonly IPureSdk _bridge;
 
         public PureSDK()
         {
-            switch (Application.platform)
-            {
-                case RuntimePlatform.Android:
-                    #if UNITY_ANDROID
-                    _bridge = new AndroidBridge();
-                    #endif
-                    break;
-                case RuntimePlatform.IPhonePlayer:
-                    #if UNITY_IOS
-                    _bridge = new IosBridge();
-                    #endif
-                    break;
-                default:
-                    Debug.Log("Unacast SDK only available on iOS/Android - unsupported platform [" + Application.platform +
-                              "] using mocked functionality.");
-                    _bridge = new FakeBridge();
-                    break;
+            using (InitMarker.Auto())
+            {
+                switch (Application.platform)
+                {
+                    case RuntimePlatform.Android:
+                        #if UNITY_ANDROID
+                        _bridge = new AndroidBridge();
+                        #endif
+                        break;
+                    case RuntimePlatform.IPhonePlayer:
+                        #if UNITY_IOS
+                        _bridge = new IosBridge();
+                        #endif
+                        break;
+                    default:
+                        Debug.Log("Unacast SDK only available on iOS/Android - unsupported platform [" + Application.platform +
+                                  "] using mocked functionality.");
+                        var settings = PureSDKSettings.ReadOnlyCopyOrDefault();
+                        _bridge = new FakeBridge(settings.fakePermissionDelaySeconds, settings.fakePermissionDenied);
+                        break;
+                }
             }
         }
         
@@ -36,7 +50,10 @@ namespace Unaty.PureSDK
         /// </summary>
         public void StartTracking()
         {
-            _bridge.StartTracking();
+            using (StartTrackingMarker.Auto())
+            {
+                _bridge.StartTracking();
+            }
         }
 
         /// <summary>
@@ -44,7 +61,10 @@ namespace Unaty.PureSDK
         /// </summary>
         public void StopTracking()
         {
-            _bridge.StopTracking();
+            using (StopTrackingMarker.Auto())
+            {
+                _bridge.StopTracking();
+            }
         }
 
         /// <summary>
@@ -53,7 +73,59 @@ namespace Unaty.PureSDK
         /// <returns>true if tracking is enabled</returns>
         public bool IsTracking()
         {
-            return _bridge.IsTracking();
+            using (IsTrackingMarker.Auto())
+            {
+                return _bridge.IsTracking();
+            }
+        }
+
+        /// <summary>
+        /// Overrides the publisher id from the Pure SDK settings, e.g. for white-label builds.
+        /// Data collected after this call is attributed to the new publisher. Calls with an unchanged id are ignored.
+        /// </summary>
+        public void SetPublisherId(string publisherId)
+        {
+            using (SetPublisherIdMarker.Auto())
+            {
+                _bridge.SetPublisherId(publisherId);
+            }
+        }
+
+        /// <summary>
+        /// Location and monetization status as reported by the SDK.
+        /// On iOS the values are cached on the native side and only marshalled again when they change, so this is cheap to poll.
+        /// On Android every call queries the permission state through JNI, and isUserMonitized is not reported.
+        /// </summary>
+        public PureTrackingInfo GetTrackingInfo()
+        {
+            using (GetTrackingInfoMarker.Auto())
+            {
+                return _bridge.GetTrackingInfo();
+            }
+        }
+
+        /// <summary>
+        /// The current session's Pure Identifier
+        /// </summary>
+        /// <returns>null until the SDK is initialized or if the platform does not expose it</returns>
+        public string GetPureIdentifier()
+        {
+            using (GetPureIdentifierMarker.Auto())
+            {
+                return _bridge.GetPureIdentifier();
+            }
+        }
+
+        /// <summary>
+        /// The native PureSDK version
+        /// </summary>
+        /// <returns>null until the SDK is initialized or if the platform does not expose it</returns>
+        public string GetVersion()
+        {
+            using (GetVersionMarker.Auto())
+            {
+                return _bridge.GetVersion();
+            }
         }
     }
 }
\ No newline at end of file
@@ -33,5 +33,25 @@ namespace Unaty.PureSDK
         {
             return sdk.IsTracking();
         }
+
+        public void SetPublisherId(string publisherId)
+        {
+            sdk.SetPublisherId(publisherId);
+        }
+
+        public PureTrackingInfo GetTrackingInfo()
+        {
+            return sdk.GetTrackingInfo();
+        }
+
+        public string GetPureIdentifier()
+        {
+            return sdk.GetPureIdentifier();
+        }
+
+        public string GetVersion()
+        {
+            return sdk.GetVersion();
+        }
     }
 }
\ No newline at end of file
@@ -12,10 +12,31 @@ namespace PureSDK
 
         [SerializeField] public bool generateLocationPlistEntries;
 
+        // Lets the iOS SDK include session lengths in its analytics payloads
+        [SerializeField] public bool lightweightAnalyticsEnabled;
+
+        // Only used by the mocked SDK in the editor and on unsupported platforms
+        [SerializeField] public float fakePermissionDelaySeconds;
+        [SerializeField] public bool fakePermissionDenied;
+
         public static PureSDKSettings ReadOnlyCopy()
         {
             var pureSdkSettings = Resources.Load<PureSDKSettings>(resourceName);
             return Instantiate(pureSdkSettings);
         }
+
+        // Only for the mocked SDK, the real bridges should fail loudly when the settings asset is missing
+        public static PureSDKSettings ReadOnlyCopyOrDefault()
+        {
+            var pureSdkSettings = Resources.Load<PureSDKSettings>(resourceName);
+            if (pureSdkSettings == null)
+            {
+                Debug.LogWarning("No Pure SDK settings found at " + settingsPath + ", the mocked SDK uses defaults. " +
+                                 "Configure the SDK under \"Window > Unacast Pure SDK > Configure ...\"");
+                return CreateInstance<PureSDKSettings>();
+            }
+
+            return Instantiate(pureSdkSettings);
+        }
     }
 }
\ No newline at end of file
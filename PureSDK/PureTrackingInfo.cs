@@ -0,0 +1,29 @@
+﻿namespace PureSDK
+{
+    /// <summary>
+    /// Mirrors CLAuthorizationStatus on iOS
+    /// </summary>
+    public enum LocationAuthorization
+    {
+        NotDetermined = 0,
+        Restricted = 1,
+        Denied = 2,
+        AuthorizedAlways = 3,
+        AuthorizedWhenInUse = 4
+    }
+
+    /// <summary>
+    /// Snapshot of the SDK tracking status, see PURTrackingInfo in Pure.h
+    /// </summary>
+    public struct PureTrackingInfo
+    {
+        public bool isTrackingEnabled;
+        public bool locationServicesEnabled;
+        public LocationAuthorization locationAuthorization;
+
+        /// <summary>
+        /// true if the SDK is collecting and delivering data. Always false on Android, where the SDK does not report it.
+        /// </summary>
+        public bool isUserMonitized;
+    }
+}
@@ -2,34 +2,171 @@
 #import "IOSWrapperImpl.h"
 #import <PureSDK/Pure.h>
 
+#include <os/signpost.h>
+#include <string.h>
+#include <time.h>
+
+// Signposts show up under "Points of Interest" in Instruments. They are close to free while no trace is recording.
+static os_log_t BridgeLog ()
+{
+	static os_log_t log;
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		log = os_log_create("com.unacast.pure.unity", "PointsOfInterest");
+	});
+	return log;
+}
+
+#define PUR_SIGNPOST_BEGIN(name) \
+	do { if (@available(iOS 12.0, *)) os_signpost_interval_begin(BridgeLog(), OS_SIGNPOST_ID_EXCLUSIVE, name); } while (0)
+
+#define PUR_SIGNPOST_END(name) \
+	do { if (@available(iOS 12.0, *)) os_signpost_interval_end(BridgeLog(), OS_SIGNPOST_ID_EXCLUSIVE, name); } while (0)
+
 @implementation IOSWrapper
+{
+	int _infoGeneration;
+	BOOL _isTracking;
+	BOOL _locationServicesEnabled;
+	int _locationAuthorization;
+	BOOL _isUserMonitized;
+	char _pureIdentifier[128];
+	char _version[32];
+}
 
 - (id)init
 {
     self = [super init];
+	if (self)
+	{
+		[self refreshCachedInfo];
+		[[NSNotificationCenter defaultCenter] addObserver:self
+												 selector:@selector(refreshCachedInfo)
+													 name:UIApplicationDidBecomeActiveNotification
+												   object:nil];
+	}
     return self;
 }
 
+// Copies src into a fixed UTF-8 buffer, returns YES if the contents changed
+static BOOL UpdateUTF8Buffer (char* buffer, size_t size, NSString* src)
+{
+	const char* utf8 = src != nil ? [src UTF8String] : "";
+	if (strncmp(buffer, utf8, size - 1) == 0)
+		return NO;
+
+	strlcpy(buffer, utf8, size);
+	return YES;
+}
+
+- (void)refreshCachedInfo
+{
+	PUR_SIGNPOST_BEGIN("RefreshCachedInfo");
+	PURTrackingInfo* info = Pure.isInitialized ? Pure.trackingInfo : nil;
+	BOOL changed = NO;
+
+	BOOL isTracking = Pure.isTracking;
+	if (isTracking != _isTracking)
+	{
+		_isTracking = isTracking;
+		changed = YES;
+	}
+
+	BOOL locationServicesEnabled = info != nil && info.locationServicesEnabled;
+	int locationAuthorization = info != nil ? (int) info.locationAuthorization : (int) kCLAuthorizationStatusNotDetermined;
+	BOOL isUserMonitized = info != nil && info.isUserMonitized;
+
+	if (locationServicesEnabled != _locationServicesEnabled ||
+		locationAuthorization != _locationAuthorization ||
+		isUserMonitized != _isUserMonitized)
+	{
+		_locationServicesEnabled = locationServicesEnabled;
+		_locationAuthorization = locationAuthorization;
+		_isUserMonitized = isUserMonitized;
+		changed = YES;
+	}
+
+	if (Pure.isInitialized)
+	{
+		changed |= UpdateUTF8Buffer(_pureIdentifier, sizeof(_pureIdentifier), Pure.pureIdentifier);
+		changed |= UpdateUTF8Buffer(_version, sizeof(_version), Pure.version);
+	}
+
+	if (changed)
+		_infoGeneration++;
+	PUR_SIGNPOST_END("RefreshCachedInfo");
+}
+
 - (void)startTracking
 {
+	PUR_SIGNPOST_BEGIN("RequestPermissions");
 	SEL requestPermissions = NSSelectorFromString(@"requestPermissionsIfPossible");
 	[Pure performSelector:requestPermissions];
+	PUR_SIGNPOST_END("RequestPermissions");
+
+	PUR_SIGNPOST_BEGIN("StartTracking");
 	[Pure startTracking];
+	PUR_SIGNPOST_END("StartTracking");
+	[self refreshCachedInfo];
 }
 
 - (void)stopTracking
 {
+	PUR_SIGNPOST_BEGIN("StopTracking");
 	[Pure stopTracking];
+	PUR_SIGNPOST_END("StopTracking");
+	[self refreshCachedInfo];
 }
 
 - (BOOL)isTracking
 {
-	return [Pure isTracking];
+	return _isTracking;
 }
 
 - (void)setPublisherId:(NSString *) id
 {
+	// Setting the id is persisted by the SDK, skip it when nothing changed
+	if ([id isEqualToString:Pure.publisherId])
+		return;
+
+	PUR_SIGNPOST_BEGIN("SetPublisherId");
 	Pure.publisherId = id;
+	PUR_SIGNPOST_END("SetPublisherId");
+}
+
+- (void)setLightweightAnalyticsEnabled:(BOOL) enabled
+{
+	[Pure setLightweightAnalyticsEnabled:enabled];
+}
+
+- (int)infoGeneration
+{
+	return _infoGeneration;
+}
+
+- (BOOL)locationServicesEnabled
+{
+	return _locationServicesEnabled;
+}
+
+- (int)locationAuthorization
+{
+	return _locationAuthorization;
+}
+
+- (BOOL)isUserMonitized
+{
+	return _isUserMonitized;
+}
+
+- (const char*)pureIdentifierUTF8
+{
+	return _pureIdentifier;
+}
+
+- (const char*)versionUTF8
+{
+	return _version;
 }
 
 @end
@@ -45,6 +182,17 @@ NSString* CreateNSString (const char* string)
 	return [NSString stringWithUTF8String: ""];
 }
 
+// Copies a cached UTF-8 string into a caller owned buffer without allocating.
+// Returns the number of bytes written, excluding the terminator.
+static int CopyUTF8 (const char* src, char* buffer, int length)
+{
+	if (buffer == NULL || length <= 0)
+		return 0;
+
+	size_t written = strlcpy(buffer, src, (size_t) length);
+	return (int) MIN(written, (size_t) length - 1);
+}
+
 extern "C" {
 
 	void _SetPublisherID (const char* publisherID)
@@ -55,6 +203,14 @@ extern "C" {
 		[iosWrapperInstance setPublisherId: CreateNSString(publisherID)];
 	}
 
+	void _SetLightweightAnalyticsEnabled (bool enabled)
+	{
+		if (iosWrapperInstance == nil)
+			iosWrapperInstance = [[IOSWrapper alloc] init];
+
+		[iosWrapperInstance setLightweightAnalyticsEnabled: enabled];
+	}
+
 	void _StartTracking ()
 	{
 	
@@ -82,4 +238,60 @@ extern "C" {
         return [iosWrapperInstance isTracking];  
     }
 	
+    int _GetInfoGeneration ()
+    {
+        if (iosWrapperInstance == nil)
+            iosWrapperInstance = [[IOSWrapper alloc] init];
+
+        return [iosWrapperInstance infoGeneration];
+    }
+
+    bool _IsLocationServicesEnabled ()
+    {
+        if (iosWrapperInstance == nil)
+            iosWrapperInstance = [[IOSWrapper alloc] init];
+
+        return [iosWrapperInstance locationServicesEnabled];
+    }
+
+    int _GetLocationAuthorization ()
+    {
+        if (iosWrapperInstance == nil)
+            iosWrapperInstance = [[IOSWrapper alloc] init];
+
+        return [iosWrapperInstance locationAuthorization];
+    }
+
+    bool _IsUserMonitized ()
+    {
+        if (iosWrapperInstance == nil)
+            iosWrapperInstance = [[IOSWrapper alloc] init];
+
+        return [iosWrapperInstance isUserMonitized];
+    }
+
+    int _CopyPureIdentifier (char* buffer, int length)
+    {
+        if (iosWrapperInstance == nil)
+            iosWrapperInstance = [[IOSWrapper alloc] init];
+
+        return CopyUTF8([iosWrapperInstance pureIdentifierUTF8], buffer, length);
+    }
+
+    int _CopyVersion (char* buffer, int length)
+    {
+        if (iosWrapperInstance == nil)
+            iosWrapperInstance = [[IOSWrapper alloc] init];
+
+        return CopyUTF8([iosWrapperInstance versionUTF8], buffer, length);
+    }
+
+    // Nanoseconds since boot. On Darwin CLOCK_MONOTONIC keeps counting while the device sleeps and can't be set by the user.
+    long long _GetBootTimeNanoseconds ()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (long long) now.tv_sec * 1000000000LL + now.tv_nsec;
+    }
+
 }
@@ -9,10 +9,30 @@
 - (void)stopTracking;
 
 // To check if we are tracking. State is remembered between launches.
+// Returns the value cached by refreshCachedInfo, which is the single source of truth for the C# bridge.
 - (BOOL)isTracking;
 
-// Set the publisher id to be sendt to the API
+// Set the publisher id to be sendt to the API. Does nothing if the id is unchanged.
 - (void)setPublisherId:(NSString *) id;
 
+// Enables session length reporting in the SDK analytics payloads
+- (void)setLightweightAnalyticsEnabled:(BOOL) enabled;
+
+// Re-reads isTracking, trackingInfo, pureIdentifier and version from the SDK and bumps infoGeneration if anything changed.
+// Called on init, on start/stop and whenever the app becomes active.
+- (void)refreshCachedInfo;
+
+// Incremented every time one of the cached values below changes.
+- (int)infoGeneration;
+
+// Cached values of Pure.trackingInfo
+- (BOOL)locationServicesEnabled;
+- (int)locationAuthorization;
+- (BOOL)isUserMonitized;
+
+// Cached, null terminated UTF-8 copies of Pure.pureIdentifier and Pure.version. Empty until the SDK is initialized.
+- (const char*)pureIdentifierUTF8;
+- (const char*)versionUTF8;
+
 @end
 